@@ -8,6 +8,11 @@
 #include "arcade/API/IEntity.hpp"
 #include "arcade/API/IError.hpp"
 #include "arcade/API/IEvent.hpp"
+#include "arcade/API/IFrameRecorder.hpp"
 #include "arcade/API/IGame.hpp"
+#include "arcade/API/IPluginDiscovery.hpp"
+#include "arcade/API/IProfiler.hpp"
+#include "arcade/API/IReplay.hpp"
+#include "arcade/API/ISpatialIndex.hpp"
 #include "arcade/API/ISprite.hpp"
 #include "arcade/API/Math.hpp"
@@ -1,9 +1,19 @@
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
 #include <string>
 #include <vector>
 #include "Math.hpp"
 
+/**
+ * @brief Alignment in bytes of the pixel buffers returned by getPixels
+ * Enough for aligned SSE2 and AVX2 loads and stores
+ *
+ */
+#define ARCADE_PIXELS_ALIGNMENT 32
+
 namespace arcade::api
 {
     namespace math
@@ -21,8 +31,32 @@ namespace arcade::api
         class Rectangle;
     } // namespace math
 
+    /**
+     * @brief Forward declaration of arcade::IFrameBufferProvider
+     *
+     */
+    class IFrameBufferProvider;
+
     namespace utils
     {
+        /**
+         * @brief Forward declaration of FrameBuffer
+         *
+         */
+        struct FrameBuffer;
+
+        /**
+         * @brief Forward declaration of SpriteSheet
+         *
+         */
+        struct SpriteSheet;
+
+        /**
+         * @brief Forward declaration of SpriteInstance
+         *
+         */
+        struct SpriteInstance;
+
         /**
          * @brief API Implementation of Colors
          * Thoses values are the standardised RGB values
@@ -50,17 +84,114 @@ namespace arcade::api
             WHITE   = 0xFFFFFFFF
         };
 
+        /**
+         * @brief How the drawn pixels are combined with the canvas
+         * BLEND_NONE overwrites the destination pixels
+         * BLEND_ALPHA uses the alpha byte of the ABGR color:
+         * dst = (src * a + dst * (255 - a)) / 255 for each channel
+         *
+         */
+        enum BlendMode
+        {
+            BLEND_NONE,
+            BLEND_ALPHA
+        };
+
+        /**
+         * @brief Handle of a string interned by the canvas
+         * Two equal strings interned at the same time have the same handle
+         * so engines can cache their glyphs and layout by handle
+         * Handles start at 1 (never ARCADE_TEXT_NOT_INTERNED) and are never
+         * reused, a string interned again after being released gets a new
+         * handle, so a cached layout can never match another string
+         *
+         */
+        using TextHandle = unsigned int;
+
+/**
+ * @brief Handle of the texts drawn with a std::string (never interned)
+ * Engines should not cache their layout by handle
+ *
+ */
+#define ARCADE_TEXT_NOT_INTERNED 0U
+
         /**
          * @brief Implementation of informations about Texts
          * It contains the string the position and the color of the text
+         * and the handle of the interned string (ARCADE_TEXT_NOT_INTERNED
+         * if it was drawn with a std::string)
+         * The string is allocated from the frame resource of the window
          *
          */
         struct TextInfo
         {
-            std::string text;
+            std::pmr::string text;
             math::Vector2 pos;
             Color color;
+            TextHandle handle;
+        };
+
+        /**
+         * @brief Array of TextInfo allocated from the frame resource
+         *
+         */
+        using TextInfoArray = std::pmr::vector<TextInfo>;
+
+        /**
+         * @brief Type of a DrawCommand
+         * DRAW_RECT: drawRect (rect, color)
+         * DRAW_SPAN: setPixel and drawSpan (rect of height 1, color)
+         * DRAW_PIXELS: blit, the pixels are rasterized in getPixels (rect)
+         * DRAW_TEXT: drawText (rect position, color, text, string)
+         * DRAW_BOX: makeBox (rect is the surface of the window)
+         * DRAW_SPRITE: drawSprite (rect is the destination, sheet, source,
+         * scale)
+         * DRAW_SPRITE_BATCH: drawSprites (rect is the bounds of the batch,
+         * sheet, instances, count)
+         *
+         */
+        enum DrawCommandType
+        {
+            DRAW_RECT,
+            DRAW_SPAN,
+            DRAW_PIXELS,
+            DRAW_TEXT,
+            DRAW_BOX,
+            DRAW_SPRITE,
+            DRAW_SPRITE_BATCH
         };
+
+        /**
+         * @brief Retained representation of a drawing call
+         * Only the members used by the type are meaningful
+         * The string of a DRAW_TEXT is always set and copied in the frame
+         * resource (even for interned texts), so it stays valid while the
+         * front buffer is displayed even if releaseText is called
+         * blend is the blend mode of the window when the command was
+         * recorded, it is used by DRAW_RECT, DRAW_SPAN, DRAW_PIXELS,
+         * DRAW_SPRITE and DRAW_SPRITE_BATCH
+         *
+         */
+        struct DrawCommand
+        {
+            DrawCommandType type;
+            math::Rectangle rect;
+            Color color;
+            BlendMode blend;
+            TextHandle text;
+            const char *string;
+            const SpriteSheet *sheet;
+            math::Rectangle source;
+            unsigned int scale;
+            const SpriteInstance *instances;
+            std::size_t count;
+        };
+
+        /**
+         * @brief Array of DrawCommand allocated from the frame resource
+         *
+         */
+        using DrawCommandArray = std::pmr::vector<DrawCommand>;
     } // namespace utils
 
     class ISubWindow
@@ -86,6 +217,17 @@ namespace arcade::api
         virtual void drawText(const api::math::Vector2 &pos, const std::string &text,
                       const api::utils::Color color) = 0;
 
+        /**
+         * @brief Draw an interned text on the canvas
+         *
+         * @param pos The position of the pixel
+         * @param text The handle of the text (see ICanvas::internText)
+         * @param color The color of the text
+         *
+         */
+        virtual void drawText(const api::math::Vector2 &pos, const api::utils::TextHandle text,
+                      const api::utils::Color color) = 0;
+
         /**
          * @brief Draws the Rect object
          *
@@ -95,6 +237,31 @@ namespace arcade::api
          */
         virtual void drawRect(const api::math::Rectangle &rect,
                       const api::utils::Color color) = 0;
+
+        /**
+         * @brief Draws an horizontal span of pixels
+         * The span is clipped once against the surface
+         *
+         * @param pos The position of the first pixel
+         * @param length The number of pixels to draw
+         * @param color The color of the span
+         *
+         */
+        virtual void drawSpan(const api::math::Vector2 &pos, unsigned int length,
+                      const api::utils::Color color) = 0;
+
+        /**
+         * @brief Copy an ABGR pixel buffer inside the window
+         * The buffer is clipped once against the surface
+         *
+         * @param rect The destination of the buffer (its size is the buffer size)
+         * @param pixels The ABGR pixels to copy
+         * @param stride The number of bytes between two rows of pixels
+         *
+         */
+        virtual void blit(const api::math::Rectangle &rect, const uint8_t *pixels,
+                      unsigned int stride) = 0;
+
         /**
          * @brief Get the Surface object
          *
@@ -105,10 +272,19 @@ namespace arcade::api
 
         /**
          * @brief Clears the canvas
+         * Releases the frame resource in bulk
          *
          */
         virtual void clear() = 0;
 
+        /**
+         * @brief Get the frame resource of the window
+         *
+         * @return std::pmr::memory_resource * The frame resource
+         *
+         */
+        virtual std::pmr::memory_resource *getFrameResource() = 0;
+
         /**
          * @brief Get pixels
          * @return The pixel pointer
@@ -121,10 +297,19 @@ namespace arcade::api
          *
          * @param window The window to draw on
          *
-         * @return std::vector<TextInfo>& Reference to the text info array
+         * @return TextInfoArray& Reference to the text info array
          *
          */
-        virtual const std::vector<api::utils::TextInfo>& getTextInfo() const = 0;
+        virtual const api::utils::TextInfoArray &getTextInfo() const = 0;
+
+        /**
+         * @brief Get the revision of the text info
+         * It only changes when the text info differs from the previous frame
+         *
+         * @return unsigned long long The revision
+         *
+         */
+        virtual unsigned long long getTextRevision() const = 0;
 
         /**
          * @brief MakeBox (Draws a box around the given window)
@@ -134,6 +319,33 @@ namespace arcade::api
          */
         virtual void makeBox() = 0;
 
+        /**
+         * @brief Get the damaged regions of the window
+         * Every call to setPixel, drawRect, drawSpan, blit, drawText, clear
+         * and makeBox records the rectangle it touched, overlapping or
+         * adjacent rectangles should be merged together
+         *
+         * @return std::vector<Rectangle>& Reference to the damage array
+         *
+         */
+        virtual const std::vector<api::math::Rectangle> &getDamage() const = 0;
+
+        /**
+         * @brief Reset the damaged regions of the window
+         * Should be called once the window has been displayed
+         *
+         */
+        virtual void resetDamage() = 0;
+
+        /**
+         * @brief Set the blend mode of the window
+         * It applies to setPixel, drawRect, drawSpan and blit
+         *
+         * @param mode The new blend mode
+         *
+         */
+        virtual void setBlendMode(const api::utils::BlendMode mode) = 0;
+
         /**
          * @brief Destroy the ISubWindow object
          *
@@ -169,6 +381,8 @@ namespace arcade::api
 
         /**
          * @brief Draw text on the canvas
+         * The text is not interned, its TextInfo handle is
+         * ARCADE_TEXT_NOT_INTERNED
          *
          * @param pos The position of the pixel
          * @param text The text to draw
@@ -181,15 +395,81 @@ namespace arcade::api
                               const std::string &text,
                               const utils::Color color) = 0;
 
+        /**
+         * @brief Draw an interned text on the canvas
+         * Avoids hashing and copying the string every frame
+         * for texts that rarely change (menus, scores...)
+         *
+         * @param window The window to draw on
+         * @param pos The position of the pixel
+         * @param text The handle of the text (see internText)
+         * @param color The color of the text
+         *
+         */
+        virtual void drawText(unsigned int window,
+                              const math::Vector2 &pos,
+                              const utils::TextHandle text,
+                              const utils::Color color) = 0;
+
+        /**
+         * @brief Intern a string
+         * The handle stays valid until releaseText is called as many times
+         * as internText was called for that string
+         * Only texts that rarely change should be interned, dynamic texts
+         * (scores, timers...) should be drawn with a std::string
+         * If every handle was given throw a standard arcade::Error
+         *
+         * @param text The string to intern
+         * @return utils::TextHandle The handle of the string
+         *
+         */
+        virtual utils::TextHandle internText(const std::string &text) = 0;
+
+        /**
+         * @brief Release an interned string
+         * The string is removed once every internText of it is released,
+         * its handle is then invalid for good (it is never given to another
+         * string) and getText throws for it
+         * The frames already drawn are not affected as their TextInfo and
+         * DrawCommand keep their own copy of the string
+         * This should never throw an error (unknown handles are ignored)
+         *
+         * @param text The handle of the text
+         *
+         */
+        virtual void releaseText(const utils::TextHandle text) = 0;
+
+        /**
+         * @brief Get the string of an interned text
+         * If the handle is unknown throw a standard arcade::Error
+         *
+         * @param text The handle of the text
+         * @return const std::string& The string
+         *
+         */
+        virtual const std::string &getText(const utils::TextHandle text) const = 0;
+
         /**
          * @brief Get the text Info drawn to the canvas
          *
          * @param window The window to draw on
          *
-         * @return std::vector<TextInfo>& Reference to the text info array
+         * @return TextInfoArray& Reference to the text info array
          *
          */
-        virtual const std::vector<utils::TextInfo>& getTextInfo(unsigned int window) const = 0;
+        virtual const utils::TextInfoArray &getTextInfo(unsigned int window) const = 0;
+
+        /**
+         * @brief Get the revision of the text info of the given window
+         * It only changes when the text info differs from the previous
+         * frame, so engines can skip the layout of unchanged texts
+         *
+         * @param window The window
+         *
+         * @return unsigned long long The revision
+         *
+         */
+        virtual unsigned long long getTextRevision(unsigned int window) const = 0;
 
         /**
          * @brief Draws the Rect object
@@ -203,6 +483,39 @@ namespace arcade::api
                               const math::Rectangle &rect,
                               const utils::Color color) = 0;
 
+        /**
+         * @brief Draws an horizontal span of pixels
+         * The window lookup and the clipping are done once for the
+         * whole span instead of once per pixel like setPixel
+         *
+         * @param window The window to draw on
+         * @param pos The position of the first pixel
+         * @param length The number of pixels to draw
+         * @param color The color of the span
+         *
+         */
+        virtual void drawSpan(unsigned int window,
+                              const math::Vector2 &pos,
+                              unsigned int length,
+                              const utils::Color color) = 0;
+
+        /**
+         * @brief Copy an ABGR pixel buffer inside the given window
+         * The window lookup and the clipping are done once for the
+         * whole buffer, pixels outside of the surface are skipped
+         * This should be used to fill backgrounds and tilemaps
+         *
+         * @param window The window to draw on
+         * @param rect The destination of the buffer (its size is the buffer size)
+         * @param pixels The ABGR pixels to copy
+         * @param stride The number of bytes between two rows of pixels
+         *
+         */
+        virtual void blit(unsigned int window,
+                          const math::Rectangle &rect,
+                          const uint8_t *pixels,
+                          unsigned int stride) = 0;
+
         /**
          * @brief Get the Surface object
          *
@@ -215,13 +528,35 @@ namespace arcade::api
 
         /**
          * @brief Clears the canvas
+         * Clearing a full window is done every frame, it should use a
+         * vectorized fill (SSE2/AVX2 with a scalar fallback) selected
+         * at runtime depending on the CPU
+         * It also releases the frame resource of the window in bulk
          * @param window The window to draw on
          *
          */
         virtual void clear(unsigned int window) = 0;
 
+        /**
+         * @brief Get the frame resource of the given window
+         * Monotonic allocator used for everything drawn during a frame
+         * (TextInfo, draw commands...) that is released in bulk by clear
+         * so a steady-state frame does no heap allocation
+         * The games can also use it for their own per-frame data
+         * Everything allocated from it is invalid after clear
+         * @param window The window
+         * @return std::pmr::memory_resource * The frame resource
+         *
+         */
+        virtual std::pmr::memory_resource *getFrameResource(unsigned int window) = 0;
+
         /**
          * @brief Get pixels
+         * The pixels are stored in ABGR (4 bytes per pixel) row by row
+         * without padding and the buffer is aligned on
+         * ARCADE_PIXELS_ALIGNMENT bytes
+         * If the pixels come from an IFrameBufferProvider the rows are
+         * separated by the stride of the frame buffer (see getFrameBuffer)
          * @param window The window to draw on
          * @return The pixel pointer
          *
@@ -259,6 +594,190 @@ namespace arcade::api
          */
         virtual void makeBox(unsigned int window) = 0;
 
+        /**
+         * @brief Draws a part of a sprite sheet scaled with nearest neighbor
+         * Scaled sprites should be blitted from an ISpriteCache instead of
+         * being scaled again every frame
+         * The pixels are blended with the blend mode of the window
+         *
+         * @param window The window to draw on
+         * @param sheet The sheet to draw from (must outlive the frame)
+         * @param source The part of the sheet to draw
+         * @param pos The position of the sprite
+         * @param scale The scale of the sprite
+         *
+         */
+        virtual void drawSprite(unsigned int window,
+                                const utils::SpriteSheet &sheet,
+                                const math::Rectangle &source,
+                                const math::Vector2 &pos,
+                                unsigned int scale) = 0;
+
+        /**
+         * @brief Draws a batch of sprites sharing the same sheet
+         * The window lookup and the clipping are done once for the whole
+         * batch and the nearest neighbor scaling is a tight loop instead
+         * of one setPixel per pixel
+         * The pixels are blended with the blend mode of the window
+         * In command list mode the instances are copied in the frame
+         * resource of the window
+         *
+         * @param window The window to draw on
+         * @param sheet The sheet to draw from (must outlive the frame)
+         * @param instances The sprites to draw
+         * @param count The number of sprites
+         *
+         */
+        virtual void drawSprites(unsigned int window,
+                                 const utils::SpriteSheet &sheet,
+                                 const utils::SpriteInstance *instances,
+                                 std::size_t count) = 0;
+
+        /**
+         * @brief Get the damaged regions of the given window
+         * Every call to setPixel, drawRect, drawSpan, blit, drawText, clear,
+         * makeBox, drawSprite and drawSprites records the rectangle it
+         * touched (relative to the window surface)
+         * Overlapping or adjacent rectangles should be merged together
+         * so the IDisplayEngine only re-uploads the changed regions
+         * An empty array means nothing changed since the last display
+         *
+         * @param window The window
+         *
+         * @return std::vector<Rectangle>& Reference to the damage array
+         *
+         */
+        virtual const std::vector<math::Rectangle> &getDamage(unsigned int window) const = 0;
+
+        /**
+         * @brief Reset the damaged regions of the given window
+         * Should be called by the ICore after each IDisplayEngine::display
+         * when the canvas has 1 buffer (otherwise releaseFrontBuffer
+         * resets the damage of the displayed frame)
+         *
+         * @param window The window
+         *
+         */
+        virtual void resetDamage(unsigned int window) = 0;
+
+        /**
+         * @brief Set the blend mode of the given window
+         * It applies to setPixel, drawRect, drawSpan, blit, drawSprite and
+         * drawSprites (with the alpha byte of each pixel of the sheet)
+         * The default blend mode is BLEND_NONE
+         *
+         * @param window The window
+         * @param mode The new blend mode
+         *
+         */
+        virtual void setBlendMode(unsigned int window,
+                                  const utils::BlendMode mode) = 0;
+
+        /**
+         * @brief Set the number of buffers of the canvas (1, 2 or 3)
+         * With more than one buffer every drawing call goes to the back
+         * buffer while the front buffer is being displayed
+         * The default buffer count is 1 (the canvas is its own front buffer)
+         *
+         * @param count The number of buffers
+         *
+         */
+        virtual void setBufferCount(unsigned int count) = 0;
+
+        /**
+         * @brief Freeze the back buffer as the new front buffer
+         * Called by the game thread once IGame::draw is done
+         * With 2 buffers it blocks until the previous front buffer
+         * is released (see releaseFrontBuffer), with 3 buffers it
+         * replaces the frozen frame that is not acquired yet if any
+         * With 1 buffer it does nothing
+         *
+         * The damage must never be lost:
+         * - when a frozen frame that was never acquired is replaced, the
+         *   damage of the new frozen frame is the union of its own damage
+         *   and the damage of the dropped frame (recursively), so the
+         *   IDisplayEngine and the IFrameRecorder still see every region
+         *   drawn since the last acquired frame
+         * - the new back buffer must hold the content of the frozen frame:
+         *   a recycled buffer is brought up to date by copying the union of
+         *   the damage of every frame frozen since it was last the back
+         *   buffer (with 2 buffers only the damage of the frozen frame, with
+         *   3 buffers up to two frames), copying the whole buffer is always
+         *   correct
+         *
+         */
+        virtual void swapBuffers() = 0;
+
+        /**
+         * @brief Acquire the frozen frame to hand to the IDisplayEngine
+         * Called by the display thread, it blocks until a frame is frozen
+         * by swapBuffers, the frame then stays valid and unchanged until
+         * releaseFrontBuffer so it can be displayed while the game thread
+         * updates and draws the next frame
+         * Only one frame can be acquired at a time
+         * With 1 buffer it returns the canvas itself
+         *
+         * @return const ICanvas& The front buffer
+         *
+         */
+        virtual const ICanvas &acquireFrontBuffer() = 0;
+
+        /**
+         * @brief Release the frame given by acquireFrontBuffer
+         * Called by the display thread once IDisplayEngine::display is done
+         * It resets the damaged regions of every window of that frame
+         * (so resetDamage must not be called on it) and lets swapBuffers
+         * reuse the buffer
+         *
+         */
+        virtual void releaseFrontBuffer() = 0;
+
+        /**
+         * @brief Allocate the pixels of every window from a provider
+         * The current windows are reallocated from the provider and
+         * their content is kept
+         * NULL gives the pixels back to the canvas own storage, it must be
+         * done before the IDisplayEngine owning the provider is unloaded
+         *
+         * @param provider The provider or NULL
+         *
+         */
+        virtual void setFrameBufferProvider(IFrameBufferProvider *provider) = 0;
+
+        /**
+         * @brief Get the frame buffer of the given window
+         *
+         * @param window The window
+         * @return const utils::FrameBuffer * The frame buffer or NULL if
+         * the window does not use an IFrameBufferProvider
+         *
+         */
+        virtual const utils::FrameBuffer *getFrameBuffer(unsigned int window) const = 0;
+
+        /**
+         * @brief Enable or disable the command list mode
+         * In command list mode drawRect, drawSpan, setPixel, drawText,
+         * makeBox, drawSprite and drawSprites are only recorded as
+         * DrawCommand and not rasterized (blit is still rasterized and
+         * recorded as DRAW_PIXELS) so the engines can draw them natively
+         * The default is disabled
+         *
+         * @param enabled Whether the command list mode is enabled
+         *
+         */
+        virtual void setCommandListMode(bool enabled) = 0;
+
+        /**
+         * @brief Get the draw commands of the given window
+         * The commands are in drawing order and cleared by clear
+         * Empty when the command list mode is disabled
+         *
+         * @param window The window
+         * @return const utils::DrawCommandArray& The draw commands
+         *
+         */
+        virtual const utils::DrawCommandArray &getCommands(unsigned int window) const = 0;
+
         /**
          * @brief Destroy the ICanvas object
          *
@@ -40,6 +40,8 @@ namespace arcade::api
 
         /**
          * @brief Get the current tick
+         * It should not be polled in a loop to wait for the next tick,
+         * use an IFrameScheduler instead
          *
          * @return unsigned int The current tick
          *
@@ -60,4 +62,72 @@ namespace arcade::api
          */
         virtual ~IClock() = default;
     };
+
+    /**
+     * @brief API Implementation of IFrameScheduler (optional)
+     * Paces the loop of the ICore without spinning
+     * Its only time base is CLOCK_MONOTONIC: the deadlines are absolute
+     * CLOCK_MONOTONIC times and it sleeps until the next one with
+     * clock_nanosleep and TIMER_ABSTIME, so no drift accumulates
+     * (the IClock of the ICore is not used and is never restarted)
+     * The game is updated at a fixed timestep and the rendering rate
+     * is independent of the update rate
+     * The first update is due on the first call to waitNextFrame
+     *
+     */
+    class IFrameScheduler
+    {
+      public:
+        /**
+         * @brief Set the time between two updates
+         * It is not rounded to whole milliseconds (60 Hz is 1000.0 / 60)
+         *
+         * @param milliseconds The fixed timestep of IGame::update
+         *
+         */
+        virtual void setUpdateRate(Time milliseconds) = 0;
+
+        /**
+         * @brief Set the time between two renderings
+         * 0 renders after every update
+         *
+         * @param milliseconds The time between two IDisplayEngine::display
+         *
+         */
+        virtual void setRenderRate(Time milliseconds) = 0;
+
+        /**
+         * @brief Set the maximum number of updates run to catch up
+         * after a slow frame, the remaining late time is dropped
+         *
+         * @param updates The maximum number of updates per frame
+         *
+         */
+        virtual void setMaxCatchUp(unsigned int updates) = 0;
+
+        /**
+         * @brief Sleep until the next update or rendering deadline
+         * This should never throw an error
+         *
+         * @return unsigned int The number of IGame::update to run
+         * before the next rendering (0 if only a rendering is due)
+         *
+         */
+        virtual unsigned int waitNextFrame() = 0;
+
+        /**
+         * @brief Get the progress between the last update and the next one
+         * Can be used to interpolate the rendering
+         *
+         * @return double A ratio between 0 and 1
+         *
+         */
+        virtual double getInterpolation() const = 0;
+
+        /**
+         * @brief Destroy the IFrameScheduler object
+         *
+         */
+        virtual ~IFrameScheduler() = default;
+    };
 } // namespace arcade::api
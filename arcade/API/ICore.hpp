@@ -34,6 +34,12 @@ namespace arcade::api
      */
     class ICanvas;
 
+    /**
+     * @brief Forward declaration of arcade::IProfiler
+     *
+     */
+    class IProfiler;
+
     /**
      * @brief API Implementation of ICore
      *
@@ -60,6 +66,10 @@ namespace arcade::api
 
         /**
          * @brief Display the current canvas in the IEngine
+         * The damaged regions of every window should be reset afterwards
+         * (ICanvas::resetDamage with 1 buffer, otherwise the frame is
+         * acquired and released with ICanvas::acquireFrontBuffer and
+         * ICanvas::releaseFrontBuffer)
          *
          */
         virtual void display() = 0;
@@ -76,6 +86,9 @@ namespace arcade::api
          * before loading a new one
          * Should throw a standard arcade::Error in case of problem while
          * loading the library
+         * The game is seeded (IGame::setSeed) before its first update
+         * It should be near-instant if the game was preloaded
+         * (see IDLLoader::preloadDirectory)
          *
          */
         virtual void loadGame(const std::string &game) = 0;
@@ -85,6 +98,13 @@ namespace arcade::api
          * (D/E) could not be loaded) The (D/E) should be destroyed with inside
          * the IDLLoader before loading a new one Should throw a standard
          * arcade::Error in case of problem while loading the library
+         * It should be near-instant if the engine was preloaded
+         * (see IDLLoader::preloadDirectory)
+         * The canvas should use the IFrameBufferProvider of the new engine
+         * (ICanvas::setFrameBufferProvider) and release the one of the
+         * previous engine before it is destroyed
+         * The command list mode of the canvas should follow
+         * IDisplayEngine::supportsCommandList
          *
          */
         virtual void loadEngine(const std::string &DisplayEngine) = 0;
@@ -94,8 +114,76 @@ namespace arcade::api
          * DisplayEngine loop is generic) (This function should be called only
          * if the Game and DisplayEngine are loaded) otherwise a standard
          * arcade::Error will be thrown
+         * If the canvas has more than one buffer the frame N can be
+         * displayed on another thread (ICanvas::acquireFrontBuffer, then
+         * ICanvas::releaseFrontBuffer) while the game thread updates,
+         * draws and swaps (ICanvas::swapBuffers) the frame N + 1
+         * Between two frames the loaders whose isReloadReady is true
+         * should be reloaded (hot reload without restarting the core),
+         * the pointers to the previous objects are invalid afterwards
+         * For the DisplayEngine the canvas must release its
+         * IFrameBufferProvider before IDLLoader::reload and adopt the
+         * provider and command list support of the new engine after it,
+         * exactly like loadEngine
+         * The loop should be paced by an IFrameScheduler instead of
+         * spinning on IClock::getTick
+         * Events are applied once per fixed timestep tick: the events
+         * polled since the previous tick are gathered in one IEvent that
+         * is given to IGame::onEvent right before each IGame::update
+         * (when several updates run to catch up, the updates after the
+         * first one get no new transition)
+         * The tick given to IEventRecorder::record and
+         * IEventPlayer::pollEvent is the index of that update, counted
+         * from 0 since loadGame, so a replay does not depend on the
+         * rendering rate nor on the catch-up
+         * Each phase (pollEvent, IGame::onEvent, IGame::update, IGame::draw,
+         * IDisplayEngine::clear, IDisplayEngine::display) should be timed
+         * with ARCADE_PROFILE_SCOPE
          *
          */
         virtual void run() = 0;
+
+        /**
+         * @brief Record the events of the session in an event log
+         * (see IEventRecorder)
+         * Should be called before loadGame: the seed that loadGame gives
+         * to IGame::setSeed is written in the event log
+         * Should throw a standard arcade::Error if the event log cannot be
+         * created
+         *
+         * @param path The path to the event log
+         *
+         */
+        virtual void startRecording(const std::string &path) = 0;
+
+        /**
+         * @brief Stop recording the events of the session
+         *
+         */
+        virtual void stopRecording() = 0;
+
+        /**
+         * @brief Replay an event log (see IEventPlayer)
+         * pollEvent then gives the recorded events instead of the ones
+         * of the DisplayEngine, with a headless DisplayEngine this gives
+         * identical workloads to benchmark games and engines
+         * Should be called before loadGame: the game is then seeded with
+         * the seed of the event log (see IEventPlayer::getSeed)
+         * Should throw a standard arcade::Error if the event log cannot be
+         * opened
+         *
+         * @param path The path to the event log
+         *
+         */
+        virtual void replay(const std::string &path) = 0;
+
+        /**
+         * @brief Get the profiler of the frame phases
+         *
+         * @return IProfiler * The profiler or NULL if the core was built
+         * without ARCADE_PROFILING
+         *
+         */
+        virtual IProfiler *getProfiler() = 0;
     };
 } // namespace arcade::api
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <cstddef>
+#include <future>
 #include <string>
 
 namespace arcade::api
@@ -31,6 +33,32 @@ namespace arcade::api
          */
         virtual T *load(const std::string &path) = 0;
 
+        /**
+         * @brief Preload a library on a background thread
+         * The library is opened and its symbols are resolved but the
+         * constructor is not called, so a later load of the same path
+         * only has to call the constructor
+         * The preloaded libraries stay opened until the loader is destroyed
+         * If the library is invalid the future holds an Error
+         *
+         * @param path The path to the library
+         * @return std::shared_future<void> Ready once the library is preloaded
+         *
+         */
+        virtual std::shared_future<void> preload(const std::string &path) = 0;
+
+        /**
+         * @brief Preload every library of a directory in parallel
+         * Should be called at startup with the lib directory
+         * The libraries that are not of type T are ignored (they should be
+         * filtered with an IPluginDiscovery instead of being opened)
+         * This should never throw an Error
+         *
+         * @param directory The path to the directory
+         *
+         */
+        virtual void preloadDirectory(const std::string &directory) = 0;
+
         /**
          * @brief Unload the current library safely
          * Should never throw an Error as the destructor should
@@ -39,6 +67,58 @@ namespace arcade::api
          */
         virtual void unload() = 0;
 
+        /**
+         * @brief Watch the current library for modifications (inotify)
+         * The directory of the library is watched and only IN_CLOSE_WRITE
+         * and IN_MOVED_TO events for its name are handled, so a library
+         * that is still being written (IN_MODIFY) is never opened
+         * When the file changes it is copied to a private unique path
+         * (e.g. a memfd or a temporary file named after a counter), as
+         * dlopen of a path that is already opened returns the old library;
+         * the copy is opened and its symbols are resolved on a background
+         * thread, then isReloadReady becomes true
+         * Should throw an Error if the file cannot be watched
+         *
+         */
+        virtual void watch() = 0;
+
+        /**
+         * @brief Tells whether a new version of the library is preloaded
+         * This should never throw an Error
+         *
+         * @return true If reload can be called
+         * @return false If no new version is ready
+         *
+         */
+        virtual bool isReloadReady() const = 0;
+
+        /**
+         * @brief Swap the current library with the preloaded one
+         * Should be called at a frame boundary
+         * If both libraries export ARCADE_SAVE_STATE_SYM and
+         * ARCADE_LOAD_STATE_SYM the state of the current object is
+         * carried to the new one
+         * The current object is then destroyed with ARCADE_DESTRUCTOR_SYM
+         * and its library is closed: every pointer to that object (or to
+         * anything it owns) becomes invalid
+         * The private copy of the previous reload (if any) is removed once
+         * it is closed
+         * If the new library is invalid throw an Error and keep the
+         * current one loaded
+         *
+         * For an IDisplayEngine the caller has the same duties as
+         * ICore::loadEngine: before reload, no frame may be displayed
+         * anymore (the front buffer is released) and
+         * ICanvas::setFrameBufferProvider(NULL) must be called; after
+         * reload, the canvas adopts the IFrameBufferProvider and the
+         * command list support (IDisplayEngine::supportsCommandList)
+         * of the new object
+         *
+         * @return T* the new object of the library
+         *
+         */
+        virtual T *reload() = 0;
+
         /**
          * @brief Get the current library name
          *
@@ -77,6 +157,18 @@ extern "C"
  */
 #define ARCADE_DESTRUCTOR_SYM "__arcade_destructor"
 
+/**
+ * @brief Arcade C symbol to save the state of a module (optional)
+ *
+ */
+#define ARCADE_SAVE_STATE_SYM "__arcade_save_state"
+
+/**
+ * @brief Arcade C symbol to load the state of a module (optional)
+ *
+ */
+#define ARCADE_LOAD_STATE_SYM "__arcade_load_state"
+
 /**
  * @brief default c style constructor to load
  * a display engine module (in order to have a default symbol)
@@ -112,6 +204,35 @@ extern "C"
  */
 #define ARCADE_DESTRUCTOR void __arcade_destructor(void *cObject, bool cleanup)
 
+/**
+ * @brief C style function to save the state of a module before
+ * a hot reload (optional)
+ * The state must be plain data as the library is closed afterwards
+ * If the buffer is too small nothing is written
+ * This should never throw an exception
+ *
+ * @param cObject Object to static or C style cast
+ * @param buffer Where to write the state
+ * @param size The size of the buffer
+ * @return size_t The size of the state
+ *
+ */
+#define ARCADE_SAVE_STATE \
+    size_t __arcade_save_state(void *cObject, void *buffer, size_t size)
+
+/**
+ * @brief C style function to load the state of a module after
+ * a hot reload (optional)
+ * This should never throw an exception
+ *
+ * @param cObject Object to static or C style cast
+ * @param buffer The state given by ARCADE_SAVE_STATE
+ * @param size The size of the state
+ *
+ */
+#define ARCADE_LOAD_STATE \
+    void __arcade_load_state(void *cObject, const void *buffer, size_t size)
+
     /**
      * @brief default c style constructor to load
      * a module (in order to have a default symbol)
@@ -139,4 +260,25 @@ extern "C"
      *
      */
     ARCADE_DESTRUCTOR;
+
+    /**
+     * @brief C style function to save the state of a module (optional)
+     *
+     * @param cObject Object to static or C style cast
+     * @param buffer Where to write the state
+     * @param size The size of the buffer
+     * @return size_t The size of the state
+     *
+     */
+    ARCADE_SAVE_STATE;
+
+    /**
+     * @brief C style function to load the state of a module (optional)
+     *
+     * @param cObject Object to static or C style cast
+     * @param buffer The state to load
+     * @param size The size of the state
+     *
+     */
+    ARCADE_LOAD_STATE;
 };
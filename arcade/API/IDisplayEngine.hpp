@@ -1,5 +1,8 @@
 #pragma once
 
+#include <cstdint>
+#include "IClock.hpp"
+
 namespace arcade::api
 {
 
@@ -33,6 +36,124 @@ namespace arcade::api
      */
     class ICanvas;
 
+    namespace utils
+    {
+        /**
+         * @brief Pixel storage of a window allocated by the IDisplayEngine
+         * It can be a mapped texture of the engine or a memfd/shm segment
+         * that an other process can map to read the frames
+         *
+         */
+        struct FrameBuffer
+        {
+            /**
+             * @brief ABGR pixels of the window
+             *
+             */
+            uint8_t *pixels;
+
+            /**
+             * @brief Width of the buffer in pixels
+             *
+             */
+            unsigned int width;
+
+            /**
+             * @brief Height of the buffer in pixels
+             *
+             */
+            unsigned int height;
+
+            /**
+             * @brief Number of bytes between two rows of pixels
+             *
+             */
+            unsigned int stride;
+
+            /**
+             * @brief File descriptor of the shared memory (-1 if the
+             * buffer cannot be shared with an other process)
+             *
+             */
+            int fd;
+        };
+
+        /**
+         * @brief Implementation of the frame statistics of a run
+         * Used to benchmark games and canvas implementations
+         * Heap allocations are not part of it as the engine cannot see the
+         * ones of the game and the core, the benchmark harness counts them
+         *
+         */
+        struct FrameStats
+        {
+            /**
+             * @brief Number of frames since the start of the run
+             *
+             */
+            unsigned long long frames;
+
+            /**
+             * @brief Average number of frames per second
+             *
+             */
+            double framesPerSecond;
+
+            /**
+             * @brief Median frame time in milliseconds
+             *
+             */
+            Time p50;
+
+            /**
+             * @brief 99th percentile frame time in milliseconds
+             *
+             */
+            Time p99;
+        };
+    } // namespace utils
+
+    /**
+     * @brief API Implementation of IFrameBufferProvider (optional)
+     * Lets the ICanvas draw directly in the memory of the IDisplayEngine
+     * so that displaying a window is a flip instead of a copy
+     *
+     */
+    class IFrameBufferProvider
+    {
+      public:
+        /**
+         * @brief Allocate the pixel storage of a window
+         * The pixels must be aligned on ARCADE_PIXELS_ALIGNMENT bytes
+         * This should never throw an error
+         *
+         * @param width The width of the window
+         * @param height The height of the window
+         * @param buffer The buffer to fill
+         * @return true If the buffer was allocated
+         * @return false If it could not be allocated (the canvas then
+         * falls back to its own storage)
+         *
+         */
+        virtual bool createFrameBuffer(unsigned int width, unsigned int height,
+                                       utils::FrameBuffer &buffer) = 0;
+
+        /**
+         * @brief Free the pixel storage of a window
+         * This should never throw an error
+         *
+         * @param buffer The buffer given by createFrameBuffer
+         *
+         */
+        virtual void destroyFrameBuffer(utils::FrameBuffer &buffer) = 0;
+
+        /**
+         * @brief Destroy the IFrameBufferProvider object
+         *
+         */
+        virtual ~IFrameBufferProvider() = default;
+    };
+
     /**
      * @brief API Implementation of IDisplayEngine
      * The IDisplayEngine implementation of the pollEvent system should be like
@@ -65,6 +186,16 @@ namespace arcade::api
 
         /**
          * @brief Should draw the canvas
+         * Only the regions returned by ICanvas::getDamage needs
+         * to be uploaded again for each window
+         * It may be called on another thread than the game with
+         * the front buffer of the canvas (ICanvas::acquireFrontBuffer)
+         * If a window uses the IFrameBufferProvider of the engine
+         * its pixels should be flipped instead of copied
+         * Texts should be rendered from a glyph atlas owned by the engine
+         * and the layout of interned texts cached by TextHandle (texts with
+         * ARCADE_TEXT_NOT_INTERNED are laid out again), nothing needs to be
+         * laid out again while ICanvas::getTextRevision is unchanged
          * @param canvas The canvas to draw
          *
          */
@@ -76,10 +207,86 @@ namespace arcade::api
          */
         virtual bool isOpen() const = 0;
 
+        /**
+         * @brief Get the frame buffer provider of the engine
+         *
+         * @return IFrameBufferProvider * The provider or NULL if the
+         * engine cannot share its memory with the canvas
+         *
+         */
+        virtual IFrameBufferProvider *getFrameBufferProvider() = 0;
+
+        /**
+         * @brief Tells whether the engine draws the ICanvas draw commands
+         * natively (rects as cells, fill-rect calls...) instead of the
+         * rasterized pixels (see ICanvas::setCommandListMode)
+         *
+         */
+        virtual bool supportsCommandList() const = 0;
+
         /**
          * @brief Destroy the IDisplayEngine object
          *
          */
         virtual ~IDisplayEngine() = default;
     };
+
+    /**
+     * @brief API Implementation of IHeadlessDisplayEngine (optional)
+     * IDisplayEngine without any terminal or window (pollEvent never has
+     * an event, clear and display do no I/O) so games and canvas
+     * implementations can be benchmarked in CI or on servers
+     * supportsCommandList returns false, so the canvas is always
+     * rasterized and its pixels are what getChecksum hashes
+     *
+     */
+    class IHeadlessDisplayEngine : public IDisplayEngine
+    {
+      public:
+        /**
+         * @brief Close the engine after a number of frames
+         * isOpen returns false once that many frames are displayed
+         * 0 (the default) never closes it
+         *
+         * @param frames The number of frames
+         *
+         */
+        virtual void setFrameLimit(unsigned long long frames) = 0;
+
+        /**
+         * @brief Enable or disable the hashing of the displayed pixels
+         * Disabled by default as it reads every pixel of every frame
+         *
+         * @param enabled Whether the pixels are hashed
+         *
+         */
+        virtual void setChecksum(bool enabled) = 0;
+
+        /**
+         * @brief Get the hash of the pixels of every window of the last
+         * displayed canvas
+         * Only the width * 4 bytes of each row are hashed, the padding
+         * between the end of a row and the stride (utils::FrameBuffer) is
+         * skipped as its content is undefined
+         * Two runs replaying the same events must give the same hash
+         *
+         * @return unsigned long long The hash (0 if hashing is disabled)
+         *
+         */
+        virtual unsigned long long getChecksum() const = 0;
+
+        /**
+         * @brief Get the frame statistics since the engine was loaded
+         *
+         * @return const utils::FrameStats& The frame statistics
+         *
+         */
+        virtual const utils::FrameStats &getFrameStats() const = 0;
+
+        /**
+         * @brief Destroy the IHeadlessDisplayEngine object
+         *
+         */
+        virtual ~IHeadlessDisplayEngine() = default;
+    };
 } // namespace arcade::api
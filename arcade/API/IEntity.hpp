@@ -1,6 +1,8 @@
 #pragma once
 
+#include <cstddef>
 #include <memory>
+#include <vector>
 
 namespace arcade::api
 {
@@ -24,16 +26,92 @@ namespace arcade::api
 
     /**
      * @brief The representation of an Entity id
+     * The 32 low bits are the index of the slot of the entity
+     * and the 32 high bits are the generation of the slot
+     * The generation is incremented each time the slot is freed
+     * so an id of a removed entity never matches a new entity
+     * Generations start at 1 and a slot whose generation would wrap
+     * back to 0 is retired (never reused) so that stale ids can never
+     * become valid again and ARCADE_INVALID_ENTITY_ID is never given
      *
      */
     using EntityId = unsigned long long;
 
+/**
+ * @brief Id that is never given to an entity
+ * (generations start at 1)
+ *
+ */
+#define ARCADE_INVALID_ENTITY_ID 0ULL
+
+    /**
+     * @brief Make an EntityId from a slot index and a generation
+     *
+     * @param index The index of the slot
+     * @param generation The generation of the slot
+     * @return EntityId The id of the entity
+     *
+     */
+    constexpr EntityId makeEntityId(unsigned int index, unsigned int generation)
+    {
+        return (static_cast<EntityId>(generation) << 32) | index;
+    }
+
+    /**
+     * @brief Get the slot index of an EntityId
+     *
+     * @param id The id of the entity
+     * @return unsigned int The index of the slot
+     *
+     */
+    constexpr unsigned int getEntityIndex(EntityId id)
+    {
+        return static_cast<unsigned int>(id & 0xFFFFFFFFULL);
+    }
+
+    /**
+     * @brief Get the slot generation of an EntityId
+     *
+     * @param id The id of the entity
+     * @return unsigned int The generation of the slot
+     *
+     */
+    constexpr unsigned int getEntityGeneration(EntityId id)
+    {
+        return static_cast<unsigned int>(id >> 32);
+    }
+
     /**
      * @brief Abstraction of the shared_ptr object IEntity
      *
      */
     using EntityElement = std::shared_ptr<IEntity>;
 
+    /**
+     * @brief Update every component of an archetype at once
+     * The components are contiguous in memory
+     *
+     * @param components Pointer to the first component
+     * @param count The number of components
+     * @param userData The pointer given to registerArchetype
+     *
+     */
+    using ArchetypeUpdate = void (*)(void *components, std::size_t count,
+                                     void *userData);
+
+    /**
+     * @brief Draw every component of an archetype at once
+     * The components are contiguous in memory
+     *
+     * @param components Pointer to the first component
+     * @param count The number of components
+     * @param canvas The canvas to draw on
+     * @param userData The pointer given to registerArchetype
+     *
+     */
+    using ArchetypeDraw = void (*)(const void *components, std::size_t count,
+                                   ICanvas &canvas, void *userData);
+
     /**
      * @brief API Implementation of IEntity (optional)
      *
@@ -105,6 +183,9 @@ namespace arcade::api
       public:
         /**
          * @brief Update all the entities
+         * The entities added or removed during the iteration are
+         * applied in one batch at the end of it (see flushEntities)
+         * so no copy of the entities is needed to iterate safely
          * This should never throw an error
          *
          */
@@ -119,6 +200,8 @@ namespace arcade::api
 
         /**
          * @brief Update the events of all the entities
+         * The entities added or removed during the iteration are
+         * applied in one batch at the end of it (see flushEntities)
          * This should never throw an error
          *
          * @param event The event object
@@ -132,12 +215,41 @@ namespace arcade::api
          * EntityElement should already be created
          * and the program should be safely added with standard STL
          *
+         * The entities should be stored in a slot map: freed slots are
+         * reused and the id is made with makeEntityId
+         * If called during updateEntities or onEventEntities the entity
+         * is queued: its id is reserved immediately but it is only
+         * iterated over (and isValid) after flushEntities
+         *
          * @param entity The entity to add
          * @return EntityId The id of the entity
          *
          */
         virtual EntityId addEntity(const EntityElement &entity) = 0;
 
+        /**
+         * @brief Tells whether an id is linked to an entity
+         * This should be a slot index and generation check (O(1))
+         * This should never throw an error
+         *
+         * @param id The id of the entity
+         * @return true If the entity exists
+         * @return false If the entity was removed or never existed
+         *
+         */
+        virtual bool isValid(EntityId id) const = 0;
+
+        /**
+         * @brief Find the Entity object
+         * Same as getEntity but returns NULL instead of throwing
+         * This should never throw an error
+         *
+         * @param id The id of the entity
+         * @return IEntity * A pointer to the entity or NULL
+         *
+         */
+        virtual IEntity *findEntity(EntityId id) = 0;
+
         /**
          * @brief Get the Entity object
          * If the Entity linked to the given ID
@@ -167,6 +279,7 @@ namespace arcade::api
          * AFTER the specified entity
          * it is recommended to wrap the return value around a std::shared_ptr
          * if it is non null
+         * Prefer getEntitiesFromType to iterate over every entity of a type
          *
          * @param int EntityType
          * @param api::IEntity * pointer to the start of the search
@@ -176,20 +289,233 @@ namespace arcade::api
         virtual IEntity *getEntityFromType(int entityType,
                                            api::IEntity *lastEntity) = 0;
 
+        /**
+         * @brief Get every entity of a Type
+         * The entities are indexed by type when they are added or removed
+         * so this should never scan the whole manager
+         * The reference is invalidated by addEntity and removeEntity
+         * This should never throw an error (an unknown type gives an
+         * empty array)
+         *
+         * @param entityType The type of the entities
+         * @return const std::vector<EntityElement>& The entities of the type
+         *
+         */
+        virtual const std::vector<EntityElement> &getEntitiesFromType(
+            int entityType) const = 0;
+
         /**
          * @brief Remove an entity from the manager
          * If the Entity linked to the given ID
          * does not exists throw a standard arcade::Error
+         * If called during updateEntities or onEventEntities the removal
+         * is queued and applied by flushEntities
+         * Removing an id whose addition is still queued cancels the
+         * addition (the entity is never iterated over) and does not throw
+         * Removing an id whose removal is already queued does nothing
+         * An entity whose removal is queued is skipped for the rest of the
+         * iteration (it is not updated nor given events anymore, even if it
+         * comes later in the same pass)
          *
          * @param id The id of the entity
          *
          */
         virtual void removeEntity(EntityId id) = 0;
 
+        /**
+         * @brief Remove an entity from the manager if it exists
+         * Same as removeEntity but without throwing so that many entities
+         * can die in the same frame without exceptions
+         * It is queued the same way as removeEntity during an iteration
+         * and returns true for an id whose addition is still queued
+         * (cancelling it)
+         * This should never throw an error
+         *
+         * @param id The id of the entity
+         * @return true If the entity was removed (or its removal queued)
+         * @return false If the entity did not exist or its removal was
+         * already queued
+         *
+         */
+        virtual bool tryRemoveEntity(EntityId id) = 0;
+
+        /**
+         * @brief Apply the queued additions and removals in one batch
+         * Called automatically at the end of updateEntities and
+         * onEventEntities, it can be called again by the game at any
+         * moment outside of an iteration
+         * This should never throw an error
+         *
+         */
+        virtual void flushEntities() = 0;
+
         /**
          * @brief Destroy the IEntityManager object
          *
          */
         virtual ~IEntityManager() = default;
     };
+
+    /**
+     * @brief API Implementation of IParallelEntityManager (optional)
+     * IEntityManager whose updateEntities can spread the entities of the
+     * independent types over a work-stealing thread pool
+     *
+     * updateEntities runs in this order:
+     * - the entities of the other types, sequentially on the calling thread
+     * - the entities of the independent types, in parallel on the pool,
+     *   followed by a barrier
+     * - the ArchetypeUpdate functions (for an IArchetypeEntityManager),
+     *   sequentially on the calling thread, never on the pool
+     * - flushEntities
+     * It returns only once every update is done, so drawEntities never
+     * runs concurrently with an update
+     *
+     */
+    class IParallelEntityManager : public IEntityManager
+    {
+      public:
+        /**
+         * @brief Declare a type of entities as independent
+         * The update of an independent entity may only write its own state
+         * and must not read the mutable state of any other entity (only
+         * data that is not modified during the parallel batch, like the
+         * game settings), so it can run in parallel with any other
+         * independent entity without data race
+         * Its additions and removals are queued in a thread-safe way
+         * This should never throw an error
+         *
+         * @param entityType The type of the entities
+         * @param independent Whether the type is independent
+         *
+         */
+        virtual void setIndependentType(int entityType, bool independent) = 0;
+
+        /**
+         * @brief Set the number of threads used by updateEntities
+         * 1 (the default) keeps the update on the calling thread
+         * 0 uses one thread per available core
+         * This should never throw an error
+         *
+         * @param count The number of threads
+         *
+         */
+        virtual void setUpdateThreads(unsigned int count) = 0;
+
+        /**
+         * @brief Destroy the IParallelEntityManager object
+         *
+         */
+        virtual ~IParallelEntityManager() = default;
+    };
+
+    /**
+     * @brief API Implementation of IArchetypeEntityManager (optional)
+     * Data oriented IEntityManager: the entities of a same type
+     * (archetype) are stored as plain components in a contiguous array
+     * and updated/drawn linearly by a single function per type
+     * instead of one virtual call per entity
+     * It can still store classic EntityElement through the
+     * IEntityManager interface
+     *
+     * updateEntities calls the update function of every archetype
+     * (in registration order) after updating the classic entities and
+     * drawEntities calls the draw function of every archetype after
+     * drawing the classic entities
+     * The ids given by addComponent share the id space of addEntity:
+     * isValid, removeEntity and tryRemoveEntity work with them but they
+     * have no IEntity, so getEntity and getEntityElement throw a standard
+     * arcade::Error, findEntity returns NULL and getEntityFromType and
+     * getEntitiesFromType never return them (use getComponents or
+     * findComponent instead)
+     *
+     */
+    class IArchetypeEntityManager : public IEntityManager
+    {
+      public:
+        /**
+         * @brief Register an archetype
+         * The components of an archetype must be trivially copyable
+         * as they might be moved in memory when a component is removed
+         * Should throw a standard arcade::Error if the type is already
+         * registered or if the alignment is not a power of two
+         *
+         * @param entityType The type of the archetype (IEntity::getType)
+         * @param componentSize The size in bytes of one component
+         * (a multiple of componentAlignment)
+         * @param componentAlignment The alignment in bytes of one component
+         * (alignof of the component type, over-aligned types are supported)
+         * @param update The function updating the components (can be NULL)
+         * @param draw The function drawing the components (can be NULL)
+         * @param userData Pointer given to update and draw (the game state
+         * for example, can be NULL)
+         *
+         */
+        virtual void registerArchetype(int entityType,
+                                       std::size_t componentSize,
+                                       std::size_t componentAlignment,
+                                       ArchetypeUpdate update,
+                                       ArchetypeDraw draw,
+                                       void *userData) = 0;
+
+        /**
+         * @brief Add a component to an archetype
+         * The component is copied at the end of the archetype array
+         * During updateEntities or onEventEntities the addition is queued
+         * like addEntity and applied by flushEntities
+         * Should throw a standard arcade::Error if the archetype is not
+         * registered
+         *
+         * @param entityType The type of the archetype
+         * @param component Pointer to the component to copy
+         * @return EntityId The id of the component
+         * (it can be removed with removeEntity)
+         *
+         */
+        virtual EntityId addComponent(int entityType,
+                                      const void *component) = 0;
+
+        /**
+         * @brief Get the components of an archetype
+         * The pointer is invalidated by addComponent, removeEntity,
+         * tryRemoveEntity and flushEntities (so by updateEntities and
+         * onEventEntities too) when they are not queued
+         * Removing a component swap-removes it: the last component of the
+         * archetype is moved in its place, so the order of the components
+         * is not kept (the array always stays compact)
+         *
+         * @param entityType The type of the archetype
+         * @return void * Pointer to the first component
+         * (NULL if the archetype is empty or not registered)
+         *
+         */
+        virtual void *getComponents(int entityType) = 0;
+
+        /**
+         * @brief Find the component linked to an id
+         * The pointer is invalidated like the one of getComponents
+         * This should never throw an error
+         *
+         * @param id The id given by addComponent
+         * @return void * Pointer to the component or NULL if the id is
+         * not linked to a component
+         *
+         */
+        virtual void *findComponent(EntityId id) = 0;
+
+        /**
+         * @brief Get the number of components of an archetype
+         *
+         * @param entityType The type of the archetype
+         * @return std::size_t The number of components
+         *
+         */
+        virtual std::size_t getComponentCount(int entityType) const = 0;
+
+        /**
+         * @brief Destroy the IArchetypeEntityManager object
+         *
+         */
+        virtual ~IArchetypeEntityManager() = default;
+    };
 } // namespace arcade::api
@@ -1,5 +1,8 @@
 #pragma once
 
+#include <bitset>
+#include <cstdint>
+
 namespace arcade::api
 {
     /**
@@ -58,6 +61,12 @@ namespace arcade::api
         K_COUNT
     };
 
+    /**
+     * @brief Set of keys, one bit per KeyCode
+     *
+     */
+    using KeySet = std::bitset<K_COUNT>;
+
     /**
      * @brief API Implementation of IButton
      *
@@ -117,8 +126,33 @@ namespace arcade::api
         virtual ~IButton() = default;
     };
 
+    namespace utils
+    {
+        /**
+         * @brief Change of state of a key
+         *
+         */
+        struct KeyTransition
+        {
+            /**
+             * @brief The key (KeyCode)
+             *
+             */
+            uint8_t code;
+
+            /**
+             * @brief The new state of the key (IButton::State)
+             *
+             */
+            uint8_t state;
+        };
+    } // namespace utils
+
     /**
      * @brief API Implementation of IEvent
+     * The state of the keys should be stored in two KeySet (pressed and
+     * released) instead of one IButton per KeyCode so that the queries
+     * are a bit test and reset only clears a few words
      *
      */
     class IEvent
@@ -163,6 +197,22 @@ namespace arcade::api
          */
         virtual void reset() = 0;
 
+        /**
+         * @brief Get the keys currently pressed
+         *
+         * @return const KeySet& One bit set per pressed key
+         *
+         */
+        virtual const KeySet &getPressedKeys() const = 0;
+
+        /**
+         * @brief Get the keys currently released
+         *
+         * @return const KeySet& One bit set per released key
+         *
+         */
+        virtual const KeySet &getReleasedKeys() const = 0;
+
         /**
          * @brief Destroy the IEvent object
          *
@@ -170,6 +220,45 @@ namespace arcade::api
         virtual ~IEvent() = default;
     };
 
+    /**
+     * @brief API Implementation of IInputQueue (optional)
+     * Lock-free single producer single consumer ring of key transitions
+     * A dedicated input thread pushes the transitions it reads and
+     * the game loop pops them without ever blocking
+     *
+     */
+    class IInputQueue
+    {
+      public:
+        /**
+         * @brief Push a transition (producer thread only)
+         * This should never throw an error
+         *
+         * @param transition The transition to push
+         * @return true If the transition was pushed
+         * @return false If the ring is full
+         *
+         */
+        virtual bool push(const utils::KeyTransition &transition) = 0;
+
+        /**
+         * @brief Pop a transition (consumer thread only)
+         * This should never throw an error
+         *
+         * @param transition The transition to fill
+         * @return true If a transition was popped
+         * @return false If the ring is empty
+         *
+         */
+        virtual bool pop(utils::KeyTransition &transition) = 0;
+
+        /**
+         * @brief Destroy the IInputQueue object
+         *
+         */
+        virtual ~IInputQueue() = default;
+    };
+
 } // namespace arcade::api
 
 namespace arcade
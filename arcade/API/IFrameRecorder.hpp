@@ -0,0 +1,109 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include "IClock.hpp"
+
+namespace arcade::api
+{
+
+/**
+ * @brief Magic bytes at the start of a capture
+ *
+ */
+#define ARCADE_CAPTURE_MAGIC "ARCV"
+
+/**
+ * @brief Version of the capture format
+ *
+ */
+#define ARCADE_CAPTURE_VERSION 1
+
+    /**
+     * @brief Forward declaration of arcade::ICanvas
+     *
+     */
+    class ICanvas;
+
+    /**
+     * @brief API Implementation of IFrameRecorder (optional)
+     * Records the windows of the canvas in a streaming capture file for QA
+     * and bug reports
+     *
+     * The capture is a binary little endian file:
+     * - ARCADE_CAPTURE_MAGIC (4 bytes) and ARCADE_CAPTURE_VERSION (uint32_t)
+     * - then one record per frame: the time of the frame in milliseconds
+     *   (double), the number of windows of the frame (uint32_t) and for
+     *   each window its surface (x, y, width, height as int32_t), the size
+     *   of its data (uint32_t) and the data
+     * The windows can change during the recording (addSubWindow,
+     * destroySubWindows) as every frame describes its own windows
+     * The data of a window is its ABGR pixels XORed with the ones of the
+     * same window in the previous frame (zero for the first frame or if the
+     * window is new or its surface changed), compressed as 32-bit words
+     * runs: a uint32_t whose high bit is set for a run of zero words
+     * (the low bits are the count) or not set for a run of literal words
+     * (the low bits are the count, followed by the words)
+     * As most pixels do not change between two frames the XOR gives long
+     * runs of zeros
+     *
+     */
+    class IFrameRecorder
+    {
+      public:
+        /**
+         * @brief Create the capture and start the writer thread
+         * Should throw a standard arcade::Error if the file cannot be created
+         *
+         * @param path The path to the capture
+         * @param queueSize The maximum number of frames waiting to be written
+         *
+         */
+        virtual void open(const std::string &path, std::size_t queueSize) = 0;
+
+        /**
+         * @brief Capture a frame of the canvas
+         * Only the rows covered by the damaged regions of each window
+         * (ICanvas::getDamage) are copied in a pooled buffer and pushed to
+         * the bounded queue, the writer thread keeps the previous frame of
+         * each window and patches those rows in before the XOR, the
+         * compression and the write, so the game loop never copies a full
+         * window nor waits for the disk
+         * A window that is new or whose surface changed is copied entirely
+         * It must be called before the damage of the frame is reset
+         * (before ICanvas::releaseFrontBuffer or ICanvas::resetDamage)
+         * If the queue is full the frame is dropped instead of blocking and
+         * its damaged regions are merged in the ones of the next capture
+         * This should never throw an error
+         *
+         * @param canvas The canvas to capture (the acquired front buffer if
+         * the canvas has more than one buffer)
+         * @param time The time of the frame in milliseconds
+         * @return true If the frame was queued
+         * @return false If the frame was dropped
+         *
+         */
+        virtual bool capture(const ICanvas &canvas, Time time) = 0;
+
+        /**
+         * @brief Get the number of frames dropped because the queue was full
+         *
+         */
+        virtual std::size_t getDroppedFrames() const = 0;
+
+        /**
+         * @brief Write the queued frames, stop the writer thread and close
+         * the capture
+         * This should never throw an error
+         *
+         */
+        virtual void close() = 0;
+
+        /**
+         * @brief Destroy the IFrameRecorder object
+         * Closes the capture if it is still opened
+         *
+         */
+        virtual ~IFrameRecorder() = default;
+    };
+} // namespace arcade::api
@@ -56,6 +56,18 @@ namespace arcade::api
          */
         virtual void draw(ICanvas &canvas) = 0;
 
+        /**
+         * @brief Seed the randomness of the game
+         * Called by the ICore right after the game is loaded, before the
+         * first update: every random value of the game (food, enemies...)
+         * must come from a generator seeded with it so a replayed session
+         * behaves bit-for-bit like the recorded one
+         *
+         * @param seed The seed
+         *
+         */
+        virtual void setSeed(unsigned long long seed) = 0;
+
         /**
          * @brief Destroy the IGame object
          *
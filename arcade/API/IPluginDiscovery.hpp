@@ -0,0 +1,100 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+namespace arcade::api
+{
+    namespace utils
+    {
+        /**
+         * @brief Type of a library found by the IPluginDiscovery
+         * PLUGIN_GAME exports ARCADE_GAME_CONSTRUCTOR_SYM
+         * PLUGIN_DISPLAY_ENGINE exports ARCADE_DISPLAY_ENGINE_CONSTRUCTOR_SYM
+         * PLUGIN_UNKNOWN exports none of them (or is not a valid ELF)
+         *
+         */
+        enum PluginType
+        {
+            PLUGIN_UNKNOWN,
+            PLUGIN_GAME,
+            PLUGIN_DISPLAY_ENGINE
+        };
+
+        /**
+         * @brief Implementation of informations about a library
+         * The path, the modification time and the size are the key
+         * of the library in the manifest cache
+         * mtime is in nanoseconds since the epoch (st_mtim) so a library
+         * rebuilt within the same second is not mistaken for the cached one
+         *
+         */
+        struct PluginInfo
+        {
+            std::string path;
+            long long mtime;
+            unsigned long long size;
+            PluginType type;
+        };
+    } // namespace utils
+
+    /**
+     * @brief API Implementation of IPluginDiscovery (optional)
+     * Finds the games and display engines of a directory by reading the
+     * dynamic symbol table of the ELF files directly, so no library is
+     * opened and no static constructor is run
+     *
+     */
+    class IPluginDiscovery
+    {
+      public:
+        /**
+         * @brief Discover the libraries of a directory
+         * The files are read in parallel, the files whose path,
+         * modification time and size are in the manifest cache are
+         * not read again
+         * Should throw a standard arcade::Error if the directory
+         * cannot be opened
+         *
+         * @param directory The path to the directory
+         * @return const std::vector<utils::PluginInfo>& The libraries found
+         *
+         */
+        virtual const std::vector<utils::PluginInfo> &discover(
+            const std::string &directory) = 0;
+
+        /**
+         * @brief Set the number of threads used by discover
+         * 0 (the default) uses one thread per available core
+         *
+         * @param count The number of threads
+         *
+         */
+        virtual void setThreadCount(unsigned int count) = 0;
+
+        /**
+         * @brief Load the manifest cache from a file
+         * This should never throw an error (a missing or invalid file
+         * gives an empty cache)
+         *
+         * @param path The path to the manifest
+         *
+         */
+        virtual void loadManifest(const std::string &path) = 0;
+
+        /**
+         * @brief Save the manifest cache to a file
+         * Should throw a standard arcade::Error if the file cannot be written
+         *
+         * @param path The path to the manifest
+         *
+         */
+        virtual void saveManifest(const std::string &path) const = 0;
+
+        /**
+         * @brief Destroy the IPluginDiscovery object
+         *
+         */
+        virtual ~IPluginDiscovery() = default;
+    };
+} // namespace arcade::api
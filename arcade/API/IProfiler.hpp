@@ -0,0 +1,188 @@
+#pragma once
+
+#include <chrono>
+#include <string>
+#include "IClock.hpp"
+
+namespace arcade::api
+{
+    /**
+     * @brief All the phases of a frame of ICore::run
+     *
+     */
+    enum FramePhase
+    {
+        PHASE_POLL_EVENT,
+        PHASE_ON_EVENT,
+        PHASE_UPDATE,
+        PHASE_DRAW,
+        PHASE_CLEAR,
+        PHASE_DISPLAY,
+        // Is not a phase but
+        // is used to know how many phases are available
+        PHASE_COUNT
+    };
+
+    namespace utils
+    {
+        /**
+         * @brief Implementation of the rolling histogram of a phase
+         * It covers the last frames only so an in-game overlay can read it
+         *
+         */
+        struct PhaseHistogram
+        {
+            /**
+             * @brief Number of samples in the histogram
+             *
+             */
+            unsigned long long samples;
+
+            /**
+             * @brief Median duration in milliseconds
+             *
+             */
+            Time p50;
+
+            /**
+             * @brief 99th percentile duration in milliseconds
+             *
+             */
+            Time p99;
+
+            /**
+             * @brief Maximum duration in milliseconds
+             *
+             */
+            Time max;
+        };
+    } // namespace utils
+
+    /**
+     * @brief API Implementation of IProfiler (optional)
+     * Collects the duration of each phase of the frames so a slow frame
+     * can be attributed to a plugin
+     * The samples are stored in lock-free per-thread ring buffers
+     * Use ARCADE_PROFILE_SCOPE to time a phase
+     *
+     */
+    class IProfiler
+    {
+      public:
+        /**
+         * @brief Record the duration of a phase
+         * Pushes the sample in the ring buffer of the calling thread
+         * This should never throw an error
+         *
+         * @param phase The phase
+         * @param start The start of the phase in milliseconds (steady clock)
+         * @param duration The duration of the phase in milliseconds
+         *
+         */
+        virtual void record(FramePhase phase, Time start, Time duration) = 0;
+
+        /**
+         * @brief Enable or disable the collection at runtime
+         * This should never throw an error
+         *
+         * @param enabled Whether the samples are recorded
+         *
+         */
+        virtual void setEnabled(bool enabled) = 0;
+
+        /**
+         * @brief Tells whether the collection is enabled
+         * This should never throw an error
+         *
+         */
+        virtual bool isEnabled() const = 0;
+
+        /**
+         * @brief Get the rolling histogram of a phase
+         *
+         * @param phase The phase
+         * @return const utils::PhaseHistogram& The histogram
+         *
+         */
+        virtual const utils::PhaseHistogram &getHistogram(
+            FramePhase phase) const = 0;
+
+        /**
+         * @brief Export the samples as Chrome trace-event JSON
+         * (loadable in chrome://tracing or Perfetto)
+         * Should throw a standard arcade::Error if the file cannot be written
+         *
+         * @param path The path to the JSON file
+         *
+         */
+        virtual void exportChromeTrace(const std::string &path) const = 0;
+
+        /**
+         * @brief Destroy the IProfiler object
+         *
+         */
+        virtual ~IProfiler() = default;
+    };
+
+    /**
+     * @brief Times a phase until the end of the scope
+     * Should be used through ARCADE_PROFILE_SCOPE
+     *
+     */
+    class ProfileScope
+    {
+      private:
+        IProfiler *_profiler;
+        FramePhase _phase;
+        std::chrono::steady_clock::time_point _start;
+
+      public:
+        ProfileScope(IProfiler *profiler, FramePhase phase)
+            : _profiler(profiler && profiler->isEnabled() ? profiler : nullptr)
+            , _phase(phase)
+        {
+            if (_profiler)
+                _start = std::chrono::steady_clock::now();
+        }
+
+        ~ProfileScope()
+        {
+            using Milliseconds = std::chrono::duration<Time, std::milli>;
+
+            if (!_profiler)
+                return;
+            _profiler->record(
+                _phase,
+                Milliseconds(_start.time_since_epoch()).count(),
+                Milliseconds(std::chrono::steady_clock::now() - _start).count());
+        }
+
+        ProfileScope(const ProfileScope &) = delete;
+        ProfileScope &operator=(const ProfileScope &) = delete;
+    };
+} // namespace arcade::api
+
+/**
+ * @brief Concatenate two tokens after expanding them
+ * Used to name the variable of ARCADE_PROFILE_SCOPE after its line
+ *
+ */
+#define ARCADE_PROFILE_CONCAT_IMPL(a, b) a##b
+#define ARCADE_PROFILE_CONCAT(a, b) ARCADE_PROFILE_CONCAT_IMPL(a, b)
+
+/**
+ * @brief Times the given phase until the end of the scope
+ * It compiles to nothing unless ARCADE_PROFILING is defined
+ * At most one can be used per line
+ *
+ * @param profiler IProfiler * (can be NULL)
+ * @param phase A FramePhase expression (e.g. arcade::api::PHASE_UPDATE)
+ *
+ */
+#ifdef ARCADE_PROFILING
+#define ARCADE_PROFILE_SCOPE(profiler, phase)    \
+    arcade::api::ProfileScope ARCADE_PROFILE_CONCAT( \
+        __arcade_profile_scope_, __LINE__)(profiler, phase)
+#else
+#define ARCADE_PROFILE_SCOPE(profiler, phase)
+#endif
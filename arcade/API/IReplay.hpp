@@ -0,0 +1,140 @@
+#pragma once
+
+#include <string>
+#include "IEvent.hpp"
+
+namespace arcade::api
+{
+
+/**
+ * @brief Magic bytes at the start of an event log
+ *
+ */
+#define ARCADE_REPLAY_MAGIC "ARCR"
+
+/**
+ * @brief Version of the event log format
+ *
+ */
+#define ARCADE_REPLAY_VERSION 1
+
+    /**
+     * @brief API Implementation of IEventRecorder (optional)
+     * Writes the key transitions of a session in an event log so it can be
+     * replayed bit-for-bit
+     *
+     * The event log is a binary little endian file:
+     * - ARCADE_REPLAY_MAGIC (4 bytes) and ARCADE_REPLAY_VERSION (uint32_t)
+     * - the seed given to IGame::setSeed (uint64_t)
+     * - then one record per tick that has at least one transition:
+     *   the number of ticks since the previous record (LEB128 varint),
+     *   the number of transitions (uint8_t) and the KeyTransition array
+     * Ticks are the indexes of the fixed timestep updates of the game,
+     * counted from 0 since ICore::loadGame (see ICore::run), so the replay
+     * does not depend on the rendering speed
+     *
+     */
+    class IEventRecorder
+    {
+      public:
+        /**
+         * @brief Create the event log and write its header
+         * Should throw a standard arcade::Error if the file cannot be created
+         *
+         * @param path The path to the event log
+         * @param seed The seed of the recorded game (see IGame::setSeed)
+         *
+         */
+        virtual void open(const std::string &path, unsigned long long seed) = 0;
+
+        /**
+         * @brief Record the event of a tick
+         * Called once per tick, right before IGame::update
+         * Only the keys whose state changed since the previous tick
+         * are written
+         * This should never throw an error
+         *
+         * @param tick The index of the IGame::update the event is applied
+         * before
+         * @param event The event given to IGame::onEvent
+         *
+         */
+        virtual void record(unsigned int tick, const IEvent &event) = 0;
+
+        /**
+         * @brief Flush and close the event log
+         * This should never throw an error
+         *
+         */
+        virtual void close() = 0;
+
+        /**
+         * @brief Destroy the IEventRecorder object
+         * Closes the event log if it is still opened
+         *
+         */
+        virtual ~IEventRecorder() = default;
+    };
+
+    /**
+     * @brief API Implementation of IEventPlayer (optional)
+     * Reads an event log written by an IEventRecorder
+     * The file is memory-mapped so the replay does no read call
+     *
+     */
+    class IEventPlayer
+    {
+      public:
+        /**
+         * @brief Map the event log
+         * Should throw a standard arcade::Error if the file cannot be
+         * opened or if its magic or version is wrong
+         *
+         * @param path The path to the event log
+         *
+         */
+        virtual void open(const std::string &path) = 0;
+
+        /**
+         * @brief Apply the transitions of a tick to an event
+         * Called once per tick, right before IGame::update
+         * Ticks must be polled in increasing order
+         * This should never throw an error
+         *
+         * @param tick The tick to replay
+         * @param event The event object
+         * @return true If the tick had transitions
+         * @return false If the tick had no transition
+         *
+         */
+        virtual bool pollEvent(unsigned int tick, IEvent &event) = 0;
+
+        /**
+         * @brief Get the seed written in the header of the event log
+         *
+         * @return unsigned long long The seed to give to IGame::setSeed
+         *
+         */
+        virtual unsigned long long getSeed() const = 0;
+
+        /**
+         * @brief Tells whether every record was replayed
+         *
+         */
+        virtual bool isFinished() const = 0;
+
+        /**
+         * @brief Unmap the event log
+         * This should never throw an error
+         *
+         */
+        virtual void close() = 0;
+
+        /**
+         * @brief Destroy the IEventPlayer object
+         * Unmaps the event log if it is still mapped
+         *
+         */
+        virtual ~IEventPlayer() = default;
+    };
+} // namespace arcade::api
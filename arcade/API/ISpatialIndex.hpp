@@ -0,0 +1,96 @@
+#pragma once
+
+#include <vector>
+#include "IEntity.hpp"
+#include "Math.hpp"
+
+namespace arcade::api
+{
+    /**
+     * @brief API Implementation of ISpatialIndex (optional)
+     * Broad-phase acceleration structure for collisions (uniform grid,
+     * dynamic AABB tree...) in which the entities register their bounds
+     * The queries only return candidates whose bounds intersect,
+     * math::rectIntersect can then be used for the exact test
+     * This avoids testing every pair of entities each frame
+     *
+     */
+    class ISpatialIndex
+    {
+      public:
+        /**
+         * @brief Register the bounds of an entity
+         * If the entity is already registered its bounds are updated
+         * This should never throw an error
+         *
+         * @param id The id of the entity
+         * @param bounds The bounds of the entity
+         *
+         */
+        virtual void insert(EntityId id, const math::Rectangle &bounds) = 0;
+
+        /**
+         * @brief Update the bounds of a registered entity
+         * Should be called when the entity moves, implementations
+         * should avoid any work if it stays in the same cell/node
+         * If the entity is not registered throw a standard arcade::Error
+         *
+         * @param id The id of the entity
+         * @param bounds The new bounds of the entity
+         *
+         */
+        virtual void update(EntityId id, const math::Rectangle &bounds) = 0;
+
+        /**
+         * @brief Unregister an entity
+         * This should never throw an error (does nothing if the entity
+         * is not registered)
+         *
+         * @param id The id of the entity
+         *
+         */
+        virtual void remove(EntityId id) = 0;
+
+        /**
+         * @brief Get the entities whose bounds intersect with a rectangle
+         * The result is appended to the given array so it can be
+         * reused between queries without allocating
+         * Each entity appears at most once even if its bounds span
+         * several cells/nodes
+         * This should never throw an error
+         *
+         * @param rect The rectangle to test
+         * @param result The array to fill with the found entities
+         *
+         */
+        virtual void queryRect(const math::Rectangle &rect,
+                               std::vector<EntityId> &result) const = 0;
+
+        /**
+         * @brief Get the entities whose bounds contain a point
+         * The result is appended to the given array so it can be
+         * reused between queries without allocating
+         * Each entity appears at most once even if its bounds span
+         * several cells/nodes
+         * This should never throw an error
+         *
+         * @param pos The position to test
+         * @param result The array to fill with the found entities
+         *
+         */
+        virtual void queryPoint(const math::Vector2 &pos,
+                                std::vector<EntityId> &result) const = 0;
+
+        /**
+         * @brief Unregister every entity
+         *
+         */
+        virtual void clear() = 0;
+
+        /**
+         * @brief Destroy the ISpatialIndex object
+         *
+         */
+        virtual ~ISpatialIndex() = default;
+    };
+} // namespace arcade::api
@@ -1,5 +1,9 @@
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
+#include "Math.hpp"
+
 namespace arcade::api
 {
     /**
@@ -8,14 +12,66 @@ namespace arcade::api
      */
     class ICanvas;
 
-    namespace math
+    namespace utils
     {
         /**
-         * @brief Forward declaration of arcade::Vector2
+         * @brief Shared ABGR pixels of one or more sprites
+         * The sprites reference a part of the sheet so many sprites
+         * can be drawn from the same pixels
+         *
+         */
+        struct SpriteSheet
+        {
+            /**
+             * @brief ABGR pixels of the sheet
+             *
+             */
+            const uint8_t *pixels;
+
+            /**
+             * @brief Width of the sheet in pixels
+             *
+             */
+            unsigned int width;
+
+            /**
+             * @brief Height of the sheet in pixels
+             *
+             */
+            unsigned int height;
+
+            /**
+             * @brief Number of bytes between two rows of pixels
+             *
+             */
+            unsigned int stride;
+        };
+
+        /**
+         * @brief One sprite of a batch drawn with ICanvas::drawSprites
          *
          */
-        class Vector2;
-    } // namespace math
+        struct SpriteInstance
+        {
+            /**
+             * @brief Position of the sprite on the window
+             *
+             */
+            math::Vector2 pos;
+
+            /**
+             * @brief Nearest neighbor scale of the sprite
+             *
+             */
+            unsigned int scale;
+
+            /**
+             * @brief Part of the sheet to draw
+             *
+             */
+            math::Rectangle source;
+        };
+    } // namespace utils
 
     /**
      * @brief API Implementation of the ISprite
@@ -33,11 +89,27 @@ namespace arcade::api
 
         /**
          * @brief Draw the sprite on the canvas
+         * To draw many sprites sharing the same sheet prefer building
+         * an array of SpriteInstance and calling ICanvas::drawSprites
          *
          * @param canvas The canvas to draw on
          */
         virtual void draw(ICanvas &canvas) const = 0;
 
+        /**
+         * @brief Get the sheet of the sprite
+         *
+         * @return const utils::SpriteSheet& The pixels the sprite is drawn from
+         */
+        virtual const utils::SpriteSheet &getSheet() const = 0;
+
+        /**
+         * @brief Get the part of the sheet of the sprite
+         *
+         * @return const math::Rectangle& The source rectangle in the sheet
+         */
+        virtual const math::Rectangle &getSource() const = 0;
+
         /**
          * @brief Get the Size object
          *
@@ -66,4 +138,101 @@ namespace arcade::api
          */
         virtual void setScale(unsigned int scale) = 0;
     };
+
+    /**
+     * @brief API Implementation of ISpriteCache (optional)
+     * Keeps the nearest neighbor upscaled variants of the sprites
+     * so that drawing a scaled sprite becomes a straight blit
+     * The variants are keyed by the pixels pointer of the sheet (not the
+     * address of the SpriteSheet object), the source rectangle and the
+     * scale, and the least recently used ones are evicted above the
+     * memory budget
+     * Eviction only happens in endFrame: every frame gets a sequence
+     * number and a variant is never freed until the last frame that used
+     * it is retired by releaseFrame, as the draw commands and the front
+     * buffers of the canvas may still point to it
+     * This holds for any number of buffers, even when swapBuffers does
+     * not block (3 buffers) and frames are replaced before being displayed
+     *
+     */
+    class ISpriteCache
+    {
+      public:
+        /**
+         * @brief Get the scaled variant of a part of a sheet
+         * It is scaled and stored on the first call for a given key
+         * The returned sheet (and its address) stays valid until the
+         * frame that last used it is retired (see releaseFrame)
+         *
+         * @param sheet The sheet of the sprite
+         * @param source The part of the sheet
+         * @param scale The scale of the sprite
+         * @return const utils::SpriteSheet& The scaled pixels
+         */
+        virtual const utils::SpriteSheet &getScaled(
+            const utils::SpriteSheet &sheet, const math::Rectangle &source,
+            unsigned int scale) = 0;
+
+        /**
+         * @brief End the current frame
+         * Should be called by the ICore after each ICanvas::swapBuffers
+         * (or after each display with 1 buffer)
+         * It is the only place where variants are freed: the least
+         * recently used ones above the memory budget and the invalidated
+         * ones, if the last frame that used them is retired
+         *
+         * @return unsigned long long The sequence number of the ended frame
+         * (they start at 1 and increase by 1 every frame)
+         */
+        virtual unsigned long long endFrame() = 0;
+
+        /**
+         * @brief Retire every frame up to a sequence number
+         * Should be called by the display thread right after
+         * ICanvas::releaseFrontBuffer with the sequence of the released
+         * frame (with 1 buffer, right after the display)
+         * A frame replaced by swapBuffers before being displayed is
+         * retired by the release of the next displayed frame, as frames
+         * are displayed in order
+         * It only records the sequence (it can run concurrently with
+         * getScaled and endFrame), the variants are freed by the next endFrame
+         * This should never throw an error
+         *
+         * @param sequence The sequence returned by endFrame for the frame
+         */
+        virtual void releaseFrame(unsigned long long sequence) = 0;
+
+        /**
+         * @brief Set the memory budget of the cache
+         * The least recently used variants are evicted by endFrame
+         * while it is exceeded
+         *
+         * @param bytes The maximum size of the variants in bytes
+         */
+        virtual void setBudget(std::size_t bytes) = 0;
+
+        /**
+         * @brief Remove every variant of a sheet
+         * Should be called when the pixels of the sheet change
+         * The variants are matched by the pixels pointer of the sheet,
+         * they are no longer returned by getScaled and are freed by
+         * endFrame once no frame in flight uses them
+         *
+         * @param sheet The sheet
+         */
+        virtual void invalidate(const utils::SpriteSheet &sheet) = 0;
+
+        /**
+         * @brief Remove every variant
+         * The variants are freed by endFrame like with invalidate
+         *
+         */
+        virtual void clear() = 0;
+
+        /**
+         * @brief Destroy the ISpriteCache object
+         *
+         */
+        virtual ~ISpriteCache() = default;
+    };
 } // namespace arcade::api
@@ -154,6 +154,7 @@ namespace arcade::api
         /**
          * @brief Tells whether if a given rectangle touches/intersects with an
          * another rectangle
+         * Use an ISpatialIndex to avoid testing every pair of rectangles
          *
          * @param a The first rect surface
          * @param b The seconds rect surface